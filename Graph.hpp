@@ -4,33 +4,979 @@
 #include <string>
 #include <vector>
 #include <tuple>
+#include <cstdint>
+#include <algorithm>
+#include <iostream>
+#include <type_traits>
+#include <map>
+#include <limits>
+#include <unordered_map>
 #include "Node.hpp"
+#include "MaxHeap.hpp"
+#include "LRUCache.hpp"
+#include "illegal_exception.hpp"
 
-class Graph
+// label policy for graphs whose edges carry no label, takes no space in the edge
+struct NoLabel
 {
+};
+
+template <typename Weight, typename Label>
+class BasicGraph
+{
+    static_assert(std::is_arithmetic<Weight>::value && std::is_signed<Weight>::value, "Weight must be a signed arithmetic type");
+
 private:
+    // each edge is a tuple made of (destination index, weight, label), or (destination index, weight) with NoLabel
+    typedef typename std::conditional<std::is_same<Label, NoLabel>::value,
+                                      std::tuple<int, Weight>,
+                                      std::tuple<int, Weight, Label>>::type Edge;
+
+    // every weight type uses the comparison heap, so all instances break ties the same way
+    typedef BasicMaxHeap<Weight> Queue;
+
     std::vector<std::string> nodeIds;
     std::vector<Node> nodes;
 
     // adjacency list of a graph
-    // each node has a list of edges, each edge is a tuple made of (destination index, weight, label)
-    std::vector<std::vector<std::tuple<int, double, std::string>>> adjList;
+    // each node has a list of edges
+    std::vector<std::vector<Edge>> adjList;
+
+    // internal node indices in the order the nodes were inserted
+    // keeps every output order stable after the nodes are renumbered by reorderNodes
+    std::vector<int> insertionOrder;
+
+    // mutation epochs that key the query caches
+    // every write takes a fresh value from version, so an outdated key is never produced again
+    unsigned long long version;
+    // changed when a node is added, updated or removed, keys FINDALL results
+    unsigned long long attributeEpoch;
+    // union-find over node indices, each set holds one or more whole connected components
+    // the epoch stored at the root changes whenever a write can change a path inside the set
+    std::vector<int> componentParent;
+    std::vector<unsigned long long> componentEpoch;
+
+    LRUCache<std::tuple<std::vector<std::string>, Weight>> pathCache;
+    LRUCache<std::vector<std::string>> findAllCache;
+
+    int findComponent(int i);
+
+    // hop distance from the source to every node within k hops (-1 if not reached)
+    std::vector<int> hopDistances(int sourceIndex, int k);
+
+    static void setBit(std::vector<uint64_t> &bits, int i);
+    static bool testBit(const std::vector<uint64_t> &bits, int i);
+
+    // build an edge, dropping the label when the graph has none
+    static Edge makeEdge(int destination, Weight weight, const Label &label)
+    {
+        return makeEdge(destination, weight, label, std::is_same<Label, NoLabel>());
+    }
+    // member templates, so only the overload matching Edge is ever instantiated
+    template <typename L>
+    static Edge makeEdge(int destination, Weight weight, const L &, std::true_type)
+    {
+        return Edge(destination, weight);
+    }
+    template <typename L>
+    static Edge makeEdge(int destination, Weight weight, const L &label, std::false_type)
+    {
+        return Edge(destination, weight, label);
+    }
 
 public:
-    Graph();
+    BasicGraph();
 
     void addNode(const std::string &id, const std::string &name, const std::string &type);
-    std::string addEdge(const std::string &sourceId, const std::string &destinationId, double weight, const std::string &label);
+    std::string addEdge(const std::string &sourceId, const std::string &destinationId, Weight weight, const Label &label = Label());
     std::string removeNode(const std::string &targetID);
 
+    // bulk versions for batches, same result as applying each operation in order, one result per operation
+    std::vector<std::string> addEdges(const std::vector<std::tuple<std::string, std::string, Weight, Label>> &edges);
+    std::vector<std::string> removeNodes(const std::vector<std::string> &targetIDs);
+    void reorderNodes();
+
     void printAdjacency(const std::string &targetID);
+    void printNeighbors(const std::string &targetID, int k, bool showHops);
 
-    std::tuple<std::vector<std::string>, double> findPath(const std::string &sourceId, const std::string &destinationId);
+    std::tuple<std::vector<std::string>, Weight> findPath(const std::string &sourceId, const std::string &destinationId);
+    std::tuple<std::vector<std::string>, Weight> findPathCached(const std::string &sourceId, const std::string &destinationId);
     void findHighestPath();
     void findAll(const std::string &fieldType, const std::string &fieldValue);
 
+    void setCacheCapacity(int capacity);
+    void printCacheStats();
+
     bool isGraphEmpty();
     int getNodeIndex(const std::string &id);
 };
 
+// the default graph used by main, with double weights and string labels
+typedef BasicGraph<double, std::string> Graph;
+
+// default constructor
+template <typename Weight, typename Label>
+BasicGraph<Weight, Label>::BasicGraph() : version(0), attributeEpoch(0), pathCache(256), findAllCache(256) {}
+
+template <typename Weight, typename Label>
+int BasicGraph<Weight, Label>::getNodeIndex(const std::string &id)
+{
+    // check if the index of a node exist in the nodeId vector
+    for (int i = 0; i < nodeIds.size(); ++i)
+    {
+        if (nodeIds[i] == id)
+        {
+            // return the corresponding index
+            return i;
+        }
+    }
+    // node not found
+    return -1;
+}
+
+template <typename Weight, typename Label>
+void BasicGraph<Weight, Label>::addNode(const std::string &id, const std::string &name, const std::string &type)
+{
+    if (id.empty() || name.empty() || type.empty())
+    {
+        throw illegal_exception();
+    }
+
+    // get the node index from nodeId vector
+    int index = getNodeIndex(id);
+    // if the node already exist, just undate the value
+    if (index != -1)
+    {
+        nodes[index].update(name, type);
+        attributeEpoch = ++version;
+        return;
+    }
+
+    // if node not found, create a new node and push that node id onto the nodeIds vector
+    nodeIds.push_back(id);
+    nodes.emplace_back(id, name, type);
+    insertionOrder.push_back(nodeIds.size() - 1);
+    while (adjList.size() < nodeIds.size())
+    {
+        adjList.emplace_back();
+    }
+
+    // the new node starts in a component of its own
+    attributeEpoch = ++version;
+    componentParent.push_back(nodeIds.size() - 1);
+    componentEpoch.push_back(version);
+}
+
+template <typename Weight, typename Label>
+std::string BasicGraph<Weight, Label>::addEdge(const std::string &sourceId, const std::string &destinationId, Weight weight, const Label &label)
+{
+    std::string result = addEdges(std::vector<std::tuple<std::string, std::string, Weight, Label>>(
+        1, std::make_tuple(sourceId, destinationId, weight, label)))[0];
+
+    // a self loop or a non positive weight is an illegal argument, not a failure
+    if (result == "illegal argument")
+    {
+        throw illegal_exception();
+    }
+    return result;
+}
+
+template <typename Weight, typename Label>
+std::string BasicGraph<Weight, Label>::removeNode(const std::string &targetID)
+{
+    return removeNodes(std::vector<std::string>(1, targetID))[0];
+}
+
+template <typename Weight, typename Label>
+std::vector<std::string> BasicGraph<Weight, Label>::addEdges(const std::vector<std::tuple<std::string, std::string, Weight, Label>> &edges)
+{
+    std::vector<std::string> results;
+
+    // a batch looks every id up through one hash map instead of scanning nodeIds per edge,
+    // a single edge (addEdge) scans nodeIds directly since building the map costs more
+    std::unordered_map<std::string, int> indexOf;
+    if (edges.size() > 1)
+    {
+        for (int i = 0; i < nodeIds.size(); ++i)
+        {
+            indexOf[nodeIds[i]] = i;
+        }
+    }
+    auto lookup = [&](const std::string &id) -> int
+    {
+        if (edges.size() == 1)
+        {
+            return getNodeIndex(id);
+        }
+        auto found = indexOf.find(id);
+        return found == indexOf.end() ? -1 : found->second;
+    };
+
+    // for each node pair (smaller index first), the first and last operation that wrote it
+    std::map<std::tuple<int, int>, std::tuple<int, int>> writes;
+    std::vector<std::tuple<int, int>> endpoints(edges.size());
+    for (int k = 0; k < edges.size(); ++k)
+    {
+        const std::string &sourceId = std::get<0>(edges[k]);
+        const std::string &destinationId = std::get<1>(edges[k]);
+        Weight weight = std::get<2>(edges[k]);
+
+        if (sourceId == destinationId || weight <= 0)
+        {
+            results.push_back("illegal argument");
+            continue;
+        }
+
+        int sourceIndex = lookup(sourceId);
+        int destIndex = lookup(destinationId);
+        // if either entity does not exist in the graph
+        if (sourceIndex == -1 || destIndex == -1)
+        {
+            results.push_back("failure");
+            continue;
+        }
+
+        endpoints[k] = std::make_tuple(sourceIndex, destIndex);
+
+        std::tuple<int, int> pair(std::min(sourceIndex, destIndex), std::max(sourceIndex, destIndex));
+        auto write = writes.find(pair);
+        if (write == writes.end())
+        {
+            writes[pair] = std::make_tuple(k, k);
+        }
+        else
+        {
+            std::get<1>(write->second) = k;
+        }
+
+        // merge the two components and give the merged one a new epoch
+        int sourceRoot = findComponent(sourceIndex);
+        int destRoot = findComponent(destIndex);
+        componentParent[sourceRoot] = destRoot;
+        componentEpoch[destRoot] = ++version;
+
+        results.push_back("success");
+    }
+
+    // update the edges that already exist, one pass over the list of every touched node
+    std::vector<int> touched;
+    for (const auto &write : writes)
+    {
+        touched.push_back(std::get<0>(write.first));
+        touched.push_back(std::get<1>(write.first));
+    }
+    std::sort(touched.begin(), touched.end());
+    touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+
+    std::vector<bool> exists(edges.size(), false);
+    for (int u : touched)
+    {
+        for (auto &edge : adjList[u])
+        {
+            int v = std::get<0>(edge);
+            auto write = writes.find(std::make_tuple(std::min(u, v), std::max(u, v)));
+            if (write == writes.end())
+            {
+                continue;
+            }
+            // the last operation on the pair decides the weight and label
+            const auto &last = edges[std::get<1>(write->second)];
+            edge = makeEdge(v, std::get<2>(last), std::get<3>(last));
+            exists[std::get<0>(write->second)] = true;
+        }
+    }
+
+    // append the new edges in the order of their first operation, with the values of the last one
+    std::vector<std::tuple<int, int>> created;
+    for (const auto &write : writes)
+    {
+        if (!exists[std::get<0>(write.second)])
+        {
+            created.push_back(write.second);
+        }
+    }
+    std::sort(created.begin(), created.end());
+
+    for (const auto &write : created)
+    {
+        int sourceIndex = std::get<0>(endpoints[std::get<0>(write)]);
+        int destIndex = std::get<1>(endpoints[std::get<0>(write)]);
+        const auto &last = edges[std::get<1>(write)];
+        adjList[sourceIndex].push_back(makeEdge(destIndex, std::get<2>(last), std::get<3>(last)));
+        adjList[destIndex].push_back(makeEdge(sourceIndex, std::get<2>(last), std::get<3>(last)));
+    }
+
+    return results;
+}
+
+template <typename Weight, typename Label>
+std::vector<std::string> BasicGraph<Weight, Label>::removeNodes(const std::vector<std::string> &targetIDs)
+{
+    std::vector<std::string> results;
+
+    // a batch looks every id up through one hash map, a single DELETE scans nodeIds directly
+    std::unordered_map<std::string, int> indexOf;
+    if (targetIDs.size() > 1)
+    {
+        for (int i = 0; i < nodeIds.size(); ++i)
+        {
+            indexOf[nodeIds[i]] = i;
+        }
+    }
+
+    // mark the targets, an id that is missing or already removed fails
+    std::vector<bool> removed(nodeIds.size(), false);
+    bool anyRemoved = false;
+    for (const auto &targetID : targetIDs)
+    {
+        int targetIndex = -1;
+        if (targetIDs.size() == 1)
+        {
+            targetIndex = getNodeIndex(targetID);
+        }
+        else
+        {
+            auto target = indexOf.find(targetID);
+            targetIndex = target == indexOf.end() ? -1 : target->second;
+        }
+
+        if (targetIndex == -1 || removed[targetIndex])
+        {
+            results.push_back("failure");
+            continue;
+        }
+        removed[targetIndex] = true;
+        anyRemoved = true;
+        results.push_back("success");
+    }
+
+    if (!anyRemoved)
+    {
+        return results;
+    }
+
+    ++version;
+    attributeEpoch = version;
+
+    // a removal can only split the component sets that held a target, those sets stay merged
+    // (a set may hold several components) and get a new epoch, every other set keeps its epoch
+    std::vector<int> root(nodeIds.size());
+    for (int i = 0; i < nodeIds.size(); ++i)
+    {
+        root[i] = findComponent(i);
+    }
+    for (int i = 0; i < nodeIds.size(); ++i)
+    {
+        if (removed[i])
+        {
+            componentEpoch[root[i]] = version;
+        }
+    }
+
+    // new index of every node that stays, every later node moves down by the number of targets before it
+    // the first surviving member of each set becomes its new root
+    std::vector<int> newIndex(nodeIds.size(), -1);
+    std::vector<int> newRoot(nodeIds.size(), -1);
+    std::vector<int> updatedParent;
+    std::vector<unsigned long long> updatedEpoch;
+    int count = 0;
+    for (int i = 0; i < nodeIds.size(); ++i)
+    {
+        if (removed[i])
+        {
+            continue;
+        }
+        newIndex[i] = count++;
+        if (newRoot[root[i]] == -1)
+        {
+            newRoot[root[i]] = newIndex[i];
+        }
+        updatedParent.push_back(newRoot[root[i]]);
+        updatedEpoch.push_back(componentEpoch[root[i]]);
+    }
+    componentParent = std::move(updatedParent);
+    componentEpoch = std::move(updatedEpoch);
+
+    // remove the targets' adjacency lists, nodeIds, and node objects in a single pass
+    for (int i = 0; i < nodeIds.size(); ++i)
+    {
+        if (removed[i])
+        {
+            continue;
+        }
+        int at = newIndex[i];
+        if (at != i)
+        {
+            nodeIds[at] = std::move(nodeIds[i]);
+            nodes[at] = std::move(nodes[i]);
+        }
+
+        // delete all edges related to the targets and adjust the remaining indices
+        std::vector<Edge> updatedEdges;
+        for (auto &edge : adjList[i])
+        {
+            int neighborIndex = std::get<0>(edge);
+            if (removed[neighborIndex])
+            {
+                continue;
+            }
+            Edge shifted = edge;
+            std::get<0>(shifted) = newIndex[neighborIndex];
+            updatedEdges.push_back(shifted);
+        }
+        adjList[at] = std::move(updatedEdges);
+    }
+    nodeIds.resize(count, "");
+    nodes.erase(nodes.begin() + count, nodes.end());
+    adjList.resize(count);
+
+    // drop the targets from the insertion order
+    std::vector<int> updatedOrder;
+    for (int index : insertionOrder)
+    {
+        if (!removed[index])
+        {
+            updatedOrder.push_back(newIndex[index]);
+        }
+    }
+    insertionOrder = std::move(updatedOrder);
+
+    return results;
+}
+
+template <typename Weight, typename Label>
+void BasicGraph<Weight, Label>::reorderNodes()
+{
+    int n = nodeIds.size();
+
+    // Reverse Cuthill-McKee: BFS from a low degree node of each component,
+    // visiting neighbors by increasing degree, then reverse the whole sequence
+    std::vector<int> byDegree(n);
+    for (int i = 0; i < n; ++i)
+    {
+        byDegree[i] = i;
+    }
+    std::stable_sort(byDegree.begin(), byDegree.end(), [this](int a, int b)
+                     { return adjList[a].size() < adjList[b].size(); });
+
+    std::vector<int> sequence;
+    std::vector<bool> placed(n, false);
+    for (int start : byDegree)
+    {
+        if (placed[start])
+        {
+            continue;
+        }
+        placed[start] = true;
+        sequence.push_back(start);
+
+        // the sequence itself is the BFS queue
+        for (int head = sequence.size() - 1; head < sequence.size(); ++head)
+        {
+            std::vector<int> neighbors;
+            for (const auto &edge : adjList[sequence[head]])
+            {
+                int neighborIndex = std::get<0>(edge);
+                if (!placed[neighborIndex])
+                {
+                    placed[neighborIndex] = true;
+                    neighbors.push_back(neighborIndex);
+                }
+            }
+            std::stable_sort(neighbors.begin(), neighbors.end(), [this](int a, int b)
+                             { return adjList[a].size() < adjList[b].size(); });
+            sequence.insert(sequence.end(), neighbors.begin(), neighbors.end());
+        }
+    }
+    std::reverse(sequence.begin(), sequence.end());
+
+    // newIndex[old index] = position of the node in the new numbering
+    std::vector<int> newIndex(n);
+    for (int i = 0; i < n; ++i)
+    {
+        newIndex[sequence[i]] = i;
+    }
+
+    std::vector<std::string> reorderedIds;
+    std::vector<Node> reorderedNodes;
+    std::vector<std::vector<Edge>> reorderedAdjList(n);
+    for (int i = 0; i < n; ++i)
+    {
+        int oldIndex = sequence[i];
+        reorderedIds.push_back(std::move(nodeIds[oldIndex]));
+        reorderedNodes.push_back(std::move(nodes[oldIndex]));
+
+        // keep the edge order of every node, only the destination indices change
+        reorderedAdjList[i] = std::move(adjList[oldIndex]);
+        for (auto &edge : reorderedAdjList[i])
+        {
+            std::get<0>(edge) = newIndex[std::get<0>(edge)];
+        }
+    }
+
+    for (int &index : insertionOrder)
+    {
+        index = newIndex[index];
+    }
+
+    // carry the component sets and their epochs over to the new numbering
+    std::vector<int> reorderedParent(n);
+    std::vector<unsigned long long> reorderedEpoch(n);
+    for (int i = 0; i < n; ++i)
+    {
+        reorderedParent[newIndex[i]] = newIndex[componentParent[i]];
+        reorderedEpoch[newIndex[i]] = componentEpoch[i];
+    }
+    componentParent = std::move(reorderedParent);
+    componentEpoch = std::move(reorderedEpoch);
+
+    nodeIds = std::move(reorderedIds);
+    nodes = std::move(reorderedNodes);
+    adjList = std::move(reorderedAdjList);
+}
+
+// find the root of a node's component set, halving the path on the way
+template <typename Weight, typename Label>
+int BasicGraph<Weight, Label>::findComponent(int i)
+{
+    while (componentParent[i] != i)
+    {
+        componentParent[i] = componentParent[componentParent[i]];
+        i = componentParent[i];
+    }
+    return i;
+}
+
+template <typename Weight, typename Label>
+void BasicGraph<Weight, Label>::printAdjacency(const std::string &targetID)
+{
+    int targetIndex = getNodeIndex(targetID);
+
+    if (targetIndex == -1)
+    {
+        std::cout << "failure" << std::endl;
+        return;
+    }
+
+    // if the vertice does not have any edge, print empty line
+    if (adjList[targetIndex].empty())
+    {
+        std::cout << std::endl;
+        return;
+    }
+
+    // print the id of adjacent node
+    for (auto &edge : adjList[targetIndex])
+    {
+        std::cout << nodeIds[std::get<0>(edge)] << " ";
+    }
+    std::cout << std::endl;
+}
+
+// bitmap helpers, one bit per node index packed into 64 bit words
+template <typename Weight, typename Label>
+void BasicGraph<Weight, Label>::setBit(std::vector<uint64_t> &bits, int i)
+{
+    bits[i >> 6] |= (uint64_t(1) << (i & 63));
+}
+
+template <typename Weight, typename Label>
+bool BasicGraph<Weight, Label>::testBit(const std::vector<uint64_t> &bits, int i)
+{
+    return (bits[i >> 6] >> (i & 63)) & 1;
+}
+
+template <typename Weight, typename Label>
+std::vector<int> BasicGraph<Weight, Label>::hopDistances(int sourceIndex, int k)
+{
+    int n = nodeIds.size();
+    int words = (n + 63) / 64;
+
+    std::vector<int> hops(n, -1);
+    std::vector<uint64_t> visited(words, 0);
+    std::vector<uint64_t> frontierBits(words, 0);
+    std::vector<int> frontier;
+
+    hops[sourceIndex] = 0;
+    setBit(visited, sourceIndex);
+    frontier.push_back(sourceIndex);
+
+    // number of edge endpoints that are still unexplored, used to choose the direction of each step
+    long long unexploredEdges = 0;
+    for (const auto &edges : adjList)
+    {
+        unexploredEdges += edges.size();
+    }
+    unexploredEdges -= adjList[sourceIndex].size();
+
+    // direction switching thresholds (Beamer et al.)
+    const int alpha = 14;
+    const int beta = 24;
+    bool bottomUp = false;
+
+    for (int depth = 1; depth <= k && !frontier.empty(); ++depth)
+    {
+        // count the edges the top-down step would have to check
+        long long frontierEdges = 0;
+        for (int v : frontier)
+        {
+            frontierEdges += adjList[v].size();
+        }
+
+        if (!bottomUp && frontierEdges > unexploredEdges / alpha)
+        {
+            bottomUp = true;
+        }
+        else if (bottomUp && frontier.size() < (size_t)(n / beta))
+        {
+            bottomUp = false;
+        }
+
+        std::vector<int> next;
+
+        if (bottomUp)
+        {
+            // bottom-up: every unvisited node looks for any parent in the current frontier
+            std::fill(frontierBits.begin(), frontierBits.end(), 0);
+            for (int v : frontier)
+            {
+                setBit(frontierBits, v);
+            }
+
+            for (int v = 0; v < n; ++v)
+            {
+                if (testBit(visited, v))
+                {
+                    continue;
+                }
+                for (const auto &edge : adjList[v])
+                {
+                    if (testBit(frontierBits, std::get<0>(edge)))
+                    {
+                        next.push_back(v);
+                        break;
+                    }
+                }
+            }
+            // mark after the scan so nodes found in this step do not act as parents
+            for (int v : next)
+            {
+                setBit(visited, v);
+            }
+        }
+        else
+        {
+            // top-down: every frontier node pushes to its unvisited neighbors
+            for (int v : frontier)
+            {
+                for (const auto &edge : adjList[v])
+                {
+                    int neighborIndex = std::get<0>(edge);
+                    if (!testBit(visited, neighborIndex))
+                    {
+                        setBit(visited, neighborIndex);
+                        next.push_back(neighborIndex);
+                    }
+                }
+            }
+        }
+
+        for (int v : next)
+        {
+            hops[v] = depth;
+            unexploredEdges -= adjList[v].size();
+        }
+        frontier = std::move(next);
+    }
+
+    return hops;
+}
+
+template <typename Weight, typename Label>
+void BasicGraph<Weight, Label>::printNeighbors(const std::string &targetID, int k, bool showHops)
+{
+    int targetIndex = getNodeIndex(targetID);
+
+    if (targetIndex == -1)
+    {
+        std::cout << "failure" << std::endl;
+        return;
+    }
+
+    std::vector<int> hops = hopDistances(targetIndex, k);
+
+    // order nodes by hop count, keeping insertion order inside each hop
+    std::vector<std::tuple<int, int>> reached;
+    for (int rank = 0; rank < insertionOrder.size(); ++rank)
+    {
+        int i = insertionOrder[rank];
+        if (hops[i] > 0)
+        {
+            reached.emplace_back(hops[i], rank);
+        }
+    }
+    std::sort(reached.begin(), reached.end());
+
+    for (const auto &entry : reached)
+    {
+        std::cout << nodeIds[insertionOrder[std::get<1>(entry)]];
+        if (showHops)
+        {
+            std::cout << ":" << std::get<0>(entry);
+        }
+        std::cout << " ";
+    }
+    std::cout << std::endl;
+}
+
+template <typename Weight, typename Label>
+std::tuple<std::vector<std::string>, Weight> BasicGraph<Weight, Label>::findPath(const std::string &sourceId, const std::string &destinationId)
+{
+    int sourceIndex = getNodeIndex(sourceId);
+    int destIndex = getNodeIndex(destinationId);
+    // if either node does not exist, return an empty path and weight of -1.
+    if (sourceIndex == -1 || destIndex == -1)
+    {
+        return std::make_tuple(std::vector<std::string>(), Weight(-1));
+    }
+
+    // initialize a max heap priority queue
+    Queue queue;
+    std::vector<Weight> largestWeight(nodeIds.size(), -1);
+    std::vector<int> parent(nodeIds.size(), -1);
+    std::vector<bool> visited(nodeIds.size(), false);
+
+    // insert the starting node into the heap, initialize the weight to 0
+    queue.insert(0, sourceIndex, -1);
+    largestWeight[sourceIndex] = 0;
+
+    while (!queue.empty())
+    {
+        // get the node that has largest weight from the priority queue
+        auto top = queue.extractMax();
+        // store weight and index of the current node
+        Weight currentWeight = std::get<0>(top);
+        int currentNode = std::get<1>(top);
+
+        // if current node is visited, skip it
+        if (visited[currentNode])
+        {
+            continue;
+        }
+
+        // update the visit status of current node
+        visited[currentNode] = true;
+
+        if (currentNode == destIndex)
+        {
+            break;
+        }
+
+        for (auto &edge : adjList[currentNode])
+        {
+            // store the index of the neighboring node and the edge weight to that node
+            int neighborIndex = std::get<0>(edge);
+            Weight edgeWeight = std::get<1>(edge);
+
+            // access the neighbor only if it has not been visited
+            if (!visited[neighborIndex])
+            {
+                // an integer path weight that does not fit in Weight is rejected instead of overflowing
+                if (std::is_integral<Weight>::value && edgeWeight > std::numeric_limits<Weight>::max() - currentWeight)
+                {
+                    throw illegal_exception();
+                }
+
+                // calculate the new weight to the neighbor
+                Weight newWeight = currentWeight + edgeWeight;
+
+                // update the largestWeight if the new weight is larger
+                if (newWeight > largestWeight[neighborIndex])
+                {
+                    largestWeight[neighborIndex] = newWeight;
+                    // set current node as parent of the neighbor
+                    parent[neighborIndex] = currentNode;
+                    queue.insert(newWeight, neighborIndex, currentNode);
+                }
+            }
+        }
+    }
+
+    // if cannot reach the destination node, return empty path
+    if (largestWeight[destIndex] == -1)
+    {
+        return std::make_tuple(std::vector<std::string>(), Weight(-1));
+    }
+
+    std::vector<std::string> path;
+    for (int at = destIndex; at != -1; at = parent[at])
+    {
+        path.push_back(nodeIds[at]);
+    }
+    // reverse the path for correct order
+    std::reverse(path.begin(), path.end());
+
+    // return the path and total weight
+    return std::make_tuple(path, largestWeight[destIndex]);
+}
+
+template <typename Weight, typename Label>
+std::tuple<std::vector<std::string>, Weight> BasicGraph<Weight, Label>::findPathCached(const std::string &sourceId, const std::string &destinationId)
+{
+    int sourceIndex = getNodeIndex(sourceId);
+    int destIndex = getNodeIndex(destinationId);
+    // unknown nodes are answered directly and never cached
+    if (sourceIndex == -1 || destIndex == -1)
+    {
+        return std::make_tuple(std::vector<std::string>(), Weight(-1));
+    }
+
+    // key the query by the current epochs of both components, a write to either one makes a new key
+    std::string key = sourceId + " " + destinationId + " " +
+                      std::to_string(componentEpoch[findComponent(sourceIndex)]) + " " +
+                      std::to_string(componentEpoch[findComponent(destIndex)]);
+
+    std::tuple<std::vector<std::string>, Weight> result;
+    if (pathCache.get(key, result))
+    {
+        return result;
+    }
+
+    result = findPath(sourceId, destinationId);
+    pathCache.put(key, result);
+    return result;
+}
+
+template <typename Weight, typename Label>
+void BasicGraph<Weight, Label>::findHighestPath()
+{
+    // check if the graph is empty
+    if (isGraphEmpty())
+    {
+        std::cout << "failure" << std::endl;
+        return;
+    }
+
+    Weight maxWeight = -1;
+    std::string sourceVertex;
+    std::string destVertex;
+
+    // iterate through all the nodes in the graph, in insertion order
+    for (int a = 0; a < insertionOrder.size(); ++a)
+    {
+        int i = insertionOrder[a];
+        for (int b = a + 1; b < insertionOrder.size(); ++b)
+        {
+            int j = insertionOrder[b];
+            // find largest weight path between two node
+            auto result = findPath(nodeIds[i], nodeIds[j]);
+            std::vector<std::string> path = std::get<0>(result);
+            Weight weight = std::get<1>(result);
+
+            if (weight > maxWeight)
+            {
+                maxWeight = weight;
+                sourceVertex = nodeIds[i];
+                destVertex = nodeIds[j];
+            }
+        }
+    }
+
+    // if no path was found, return failure
+    if (maxWeight == -1)
+    {
+        std::cout << "failure" << std::endl;
+    }
+    else
+    {
+        std::cout << sourceVertex << " " << destVertex << " " << maxWeight << std::endl;
+    }
+}
+
+template <typename Weight, typename Label>
+void BasicGraph<Weight, Label>::findAll(const std::string &fieldType, const std::string &fieldValue)
+{
+    // if the field typr is not valid
+    if (fieldType != "name" && fieldType != "type")
+    {
+        std::cout << "failure" << std::endl;
+        return;
+    }
+
+    // store the ID of node
+    std::vector<std::string> results;
+
+    // reuse the result of the same query if no node changed since
+    std::string key = fieldType + " " + fieldValue + " " + std::to_string(attributeEpoch);
+    if (!findAllCache.get(key, results))
+    {
+        for (int i : insertionOrder)
+        {
+            // check if the current node's name or type matches the user input
+            std::string field = fieldType == "name" ? nodes[i].getName() : nodes[i].getType();
+            if (field == fieldValue)
+            {
+                // add the matching node ID into results
+                results.push_back(nodeIds[i]);
+            }
+        }
+        findAllCache.put(key, results);
+    }
+
+    // if no machting node was found
+    if (results.empty())
+    {
+        std::cout << "failure" << std::endl;
+    }
+    else
+    {
+        // print each ID
+        for (const auto &id : results)
+        {
+            std::cout << id << " ";
+        }
+        std::cout << std::endl;
+    }
+}
+
+// set the number of entries kept by each query cache, 0 turns caching off
+template <typename Weight, typename Label>
+void BasicGraph<Weight, Label>::setCacheCapacity(int capacity)
+{
+    if (capacity < 0)
+    {
+        throw illegal_exception();
+    }
+
+    pathCache.setCapacity(capacity);
+    findAllCache.setCapacity(capacity);
+}
+
+// print the hit and miss counts of both query caches
+template <typename Weight, typename Label>
+void BasicGraph<Weight, Label>::printCacheStats()
+{
+    std::cout << "PATH " << pathCache.getHits() << " " << pathCache.getMisses()
+              << " FINDALL " << findAllCache.getHits() << " " << findAllCache.getMisses() << std::endl;
+}
+
+// check if the graph is empty
+template <typename Weight, typename Label>
+bool BasicGraph<Weight, Label>::isGraphEmpty()
+{
+    if (nodeIds.empty())
+        return true;
+
+    for (const auto &neighbors : adjList)
+    {
+        if (!neighbors.empty())
+            return false;
+    }
+
+    return true;
+}
+
+// the default instance is compiled once in Graph.cpp
+extern template class BasicGraph<double, std::string>;
+
 #endif
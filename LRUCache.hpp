@@ -0,0 +1,98 @@
+#ifndef LRU_CACHE_HPP
+#define LRU_CACHE_HPP
+
+#include <string>
+#include <list>
+#include <utility>
+#include <unordered_map>
+
+// bounded cache of query results, the least recently used entry is evicted first
+template <typename Value>
+class LRUCache {
+private:
+    typedef std::list<std::pair<std::string, Value>> EntryList;
+
+    // entries ordered from most to least recently used
+    EntryList entries;
+    // key to the position of its entry in the list
+    std::unordered_map<std::string, typename EntryList::iterator> index;
+
+    size_t capacity;
+    long long hits;
+    long long misses;
+
+    void evict();
+
+public:
+    LRUCache(size_t capacity);
+
+    bool get(const std::string &key, Value &value);
+    void put(const std::string &key, const Value &value);
+    void setCapacity(size_t newCapacity);
+
+    long long getHits() const { return hits; }
+    long long getMisses() const { return misses; }
+};
+
+// Constructor
+template <typename Value>
+LRUCache<Value>::LRUCache(size_t capacity) : capacity(capacity), hits(0), misses(0) {}
+
+// drop least recently used entries until the cache fits its capacity
+template <typename Value>
+void LRUCache<Value>::evict()
+{
+    while (entries.size() > capacity)
+    {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+template <typename Value>
+bool LRUCache<Value>::get(const std::string &key, Value &value)
+{
+    auto it = index.find(key);
+    if (it == index.end())
+    {
+        ++misses;
+        return false;
+    }
+
+    // move the entry to the front as the most recently used
+    entries.splice(entries.begin(), entries, it->second);
+    value = it->second->second;
+    ++hits;
+    return true;
+}
+
+template <typename Value>
+void LRUCache<Value>::put(const std::string &key, const Value &value)
+{
+    if (capacity == 0)
+    {
+        return;
+    }
+
+    auto it = index.find(key);
+    if (it != index.end())
+    {
+        // overwrite the existing entry and mark it as most recently used
+        it->second->second = value;
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+
+    entries.emplace_front(key, value);
+    index[key] = entries.begin();
+    evict();
+}
+
+template <typename Value>
+void LRUCache<Value>::setCapacity(size_t newCapacity)
+{
+    capacity = newCapacity;
+    evict();
+}
+
+#endif
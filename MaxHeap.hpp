@@ -3,12 +3,15 @@
 
 #include <vector>
 #include <tuple>
+#include <algorithm>
 #include <stdexcept>
 
-class MaxHeap {
+// comparison based max priority queue, used for non integer weights
+template <typename Weight>
+class BasicMaxHeap {
 private:
     // store the heap elements as (weight, current node, parent node)
-    std::vector<std::tuple<double, int, int>> heap;
+    std::vector<std::tuple<Weight, int, int>> heap;
     
     int parent(int i) { return (i - 1) / 2; }
     int left(int i) { return 2 * i + 1; }
@@ -18,11 +21,93 @@ private:
     void heapifyUp(int i);
 
 public:
-    MaxHeap();
+    BasicMaxHeap();
 
-    void insert(double weight, int currentNode, int parentNode);
-    std::tuple<double, int, int> extractMax();
+    void insert(Weight weight, int currentNode, int parentNode);
+    std::tuple<Weight, int, int> extractMax();
     bool empty() const;
 };
 
+typedef BasicMaxHeap<double> MaxHeap;
+
+// Constructor
+template <typename Weight>
+BasicMaxHeap<Weight>::BasicMaxHeap() {}
+
+template <typename Weight>
+void BasicMaxHeap<Weight>::heapifyDown(int i)
+{
+    int largest = i;
+    int l = left(i);
+    int r = right(i);
+
+    // if the left child exists and its weight is greater than the current largest
+    if (l < heap.size() && std::get<0>(heap[l]) > std::get<0>(heap[largest]))
+    {
+        // update largest
+        largest = l;
+    }
+    // if the right child exists and its weight is greater than the current largest
+    if (r < heap.size() && std::get<0>(heap[r]) > std::get<0>(heap[largest]))
+    {
+        largest = r;
+    }
+
+    if (largest != i)
+    {
+        // if the largest if not the current element, swap them, and call heapify again
+        std::swap(heap[i], heap[largest]);
+        heapifyDown(largest);
+    }
+}
+
+template <typename Weight>
+void BasicMaxHeap<Weight>::heapifyUp(int i)
+{
+    // if current element is not the root and its parent's weight is smaller
+    while (i > 0 && std::get<0>(heap[parent(i)]) < std::get<0>(heap[i]))
+    {
+        std::swap(heap[i], heap[parent(i)]);
+        i = parent(i);
+    }
+}
+
+template <typename Weight>
+void BasicMaxHeap<Weight>::insert(Weight weight, int currentNode, int parentNode)
+{
+    // add the new element to the end of the heap
+    heap.emplace_back(weight, currentNode, parentNode);
+    // call heapifyUp to restore the heap property
+    heapifyUp(heap.size() - 1);
+}
+
+template <typename Weight>
+std::tuple<Weight, int, int> BasicMaxHeap<Weight>::extractMax()
+{
+    if (heap.empty())
+    {
+        throw std::runtime_error("Heap is empty");
+    }
+
+    // store the max element
+    auto maxElement = heap[0];
+    // replace the root withe the last element
+    heap[0] = heap.back();
+    heap.pop_back();
+    // restore heap property
+    heapifyDown(0);
+
+    return maxElement;
+}
+
+// check if the heap is empty
+template <typename Weight>
+bool BasicMaxHeap<Weight>::empty() const
+{
+    return heap.empty();
+}
+
+// the default instance is compiled once in MaxHeap.cpp
+extern template class BasicMaxHeap<double>;
+
 #endif
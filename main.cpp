@@ -2,6 +2,7 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <vector>
 #include "Graph.hpp"
 #include "illegal_exception.hpp"
 
@@ -16,12 +17,108 @@ bool isValidId(const std::string &id) {
     return true;
 }
 
+// a mutation queued between BEGIN and COMMIT
+struct PendingOperation
+{
+    std::string operation;
+    // ENTITY: id, name, type / RELATIONSHIP: source, destination, label / DELETE: id
+    // a command rejected while it was queued is kept as ILLEGAL with no args
+    std::vector<std::string> args;
+    double weight;
+};
+
+// apply the queued mutations in order and return one result per operation
+// consecutive operations of the same kind are applied together in one bulk call
+std::vector<std::string> applyBatch(Graph &graph, const std::vector<PendingOperation> &batch)
+{
+    std::vector<std::string> results;
+
+    int start = 0;
+    while (start < batch.size())
+    {
+        // find the end of the run of operations with the same kind
+        int end = start;
+        while (end < batch.size() && batch[end].operation == batch[start].operation)
+        {
+            ++end;
+        }
+
+        if (batch[start].operation == "RELATIONSHIP")
+        {
+            std::vector<std::tuple<std::string, std::string, double, std::string>> edges;
+            for (int i = start; i < end; ++i)
+            {
+                edges.emplace_back(batch[i].args[0], batch[i].args[1], batch[i].weight, batch[i].args[2]);
+            }
+            std::vector<std::string> edgeResults = graph.addEdges(edges);
+            results.insert(results.end(), edgeResults.begin(), edgeResults.end());
+        }
+        else if (batch[start].operation == "DELETE")
+        {
+            std::vector<std::string> ids;
+            for (int i = start; i < end; ++i)
+            {
+                ids.push_back(batch[i].args[0]);
+            }
+            std::vector<std::string> deleteResults = graph.removeNodes(ids);
+            results.insert(results.end(), deleteResults.begin(), deleteResults.end());
+        }
+        else if (batch[start].operation == "ENTITY")
+        {
+            for (int i = start; i < end; ++i)
+            {
+                try
+                {
+                    graph.addNode(batch[i].args[0], batch[i].args[1], batch[i].args[2]);
+                    results.push_back("success");
+                }
+                catch (const illegal_exception &e)
+                {
+                    results.push_back("illegal argument");
+                }
+            }
+        }
+        else
+        {
+            results.insert(results.end(), end - start, "illegal argument");
+        }
+
+        start = end;
+    }
+
+    return results;
+}
+
+// apply and clear the queued mutations, print each result when verbose and then the aggregate result
+void commitBatch(Graph &graph, std::vector<PendingOperation> &batch, bool verbose)
+{
+    std::vector<std::string> results = applyBatch(graph, batch);
+    batch.clear();
+
+    bool allSucceeded = true;
+    for (const auto &result : results)
+    {
+        if (verbose)
+        {
+            std::cout << result << std::endl;
+        }
+        if (result != "success")
+        {
+            allSucceeded = false;
+        }
+    }
+    std::cout << (allSucceeded ? "success" : "failure") << std::endl;
+}
 
 int main()
 {
     Graph graph;
     std::string command;
 
+    // mutations are queued instead of applied while a batch is open
+    bool inBatch = false;
+    std::vector<PendingOperation> batch;
+
     while (std::getline(std::cin, command))
     {
         std::istringstream iss(command);
@@ -30,6 +127,13 @@ int main()
 
         try
         {
+            // only mutations can be queued inside a batch
+            if (inBatch && operation != "ENTITY" && operation != "RELATIONSHIP" && operation != "DELETE" &&
+                operation != "COMMIT" && operation != "EXIT")
+            {
+                throw illegal_exception();
+            }
+
             if (operation == "LOAD")
             {
                 std::string filename, type;
@@ -80,6 +184,12 @@ int main()
                     throw illegal_exception();
                 }
 
+                if (inBatch)
+                {
+                    batch.push_back({operation, {sourceId, destId, label}, weight});
+                    continue;
+                }
+
                 if (graph.addEdge(sourceId, destId, weight, label) == "success")
                 {
                     std::cout << "success" << std::endl;
@@ -99,6 +209,12 @@ int main()
                     throw illegal_exception();
                 }
 
+                if (inBatch)
+                {
+                    batch.push_back({operation, {id, name, type}, 0});
+                    continue;
+                }
+
                 graph.addNode(id, name, type);
                 std::cout << "success" << std::endl;
             }
@@ -114,6 +230,25 @@ int main()
 
                 graph.printAdjacency(id);
             }
+            else if (operation == "NEIGHBORS")
+            {
+                std::string id, option;
+                int k;
+
+                if (!(iss >> id >> k) || !isValidId(id) || k < 1)
+                {
+                    throw illegal_exception();
+                }
+
+                // an optional trailing "hops" prints each node with its hop count
+                iss >> option;
+                if (!option.empty() && option != "hops")
+                {
+                    throw illegal_exception();
+                }
+
+                graph.printNeighbors(id, k, option == "hops");
+            }
             else if (operation == "DELETE")
             {
                 std::string id;
@@ -124,6 +259,12 @@ int main()
                     throw illegal_exception();
                 }
 
+                if (inBatch)
+                {
+                    batch.push_back({operation, {id}, 0});
+                    continue;
+                }
+
                 std::cout << graph.removeNode(id) << std::endl;
             }
             else if (operation == "PATH")
@@ -136,7 +277,7 @@ int main()
                     throw illegal_exception();
                 }
 
-                auto result = graph.findPath(id1, id2);
+                auto result = graph.findPathCached(id1, id2);
                 std::vector<std::string> path = std::get<0>(result);
                 double weight = std::get<1>(result);
 
@@ -163,8 +304,66 @@ int main()
                 iss >> fieldType >> fieldValue;
                 graph.findAll(fieldType, fieldValue);
             }
+            else if (operation == "REORDER")
+            {
+                // renumber the nodes for cache locality, output order is unchanged
+                std::string extra;
+                if (iss >> extra)
+                {
+                    throw illegal_exception();
+                }
+
+                graph.reorderNodes();
+                std::cout << "success" << std::endl;
+            }
+            else if (operation == "CACHESIZE")
+            {
+                int capacity;
+                std::string extra;
+                if (!(iss >> capacity) || iss >> extra)
+                {
+                    throw illegal_exception();
+                }
+
+                graph.setCacheCapacity(capacity);
+                std::cout << "success" << std::endl;
+            }
+            else if (operation == "CACHESTATS")
+            {
+                graph.printCacheStats();
+            }
+            else if (operation == "BEGIN")
+            {
+                if (inBatch)
+                {
+                    throw illegal_exception();
+                }
+
+                inBatch = true;
+                std::cout << "success" << std::endl;
+            }
+            else if (operation == "COMMIT")
+            {
+                // "COMMIT verbose" also prints the result of every queued command
+                std::string option;
+                iss >> option;
+
+                if (!inBatch || (!option.empty() && option != "verbose"))
+                {
+                    throw illegal_exception();
+                }
+
+                commitBatch(graph, batch, option == "verbose");
+                inBatch = false;
+            }
             else if (operation == "EXIT")
             {
+                // a batch still open at EXIT is committed, so its writes are never dropped silently
+                if (inBatch)
+                {
+                    commitBatch(graph, batch, false);
+                    inBatch = false;
+                }
                 break;
             }
             else
@@ -174,9 +373,23 @@ int main()
         }
         catch (const illegal_exception &e)
         {
-            std::cout << "illegal argument" << std::endl;
+            // a mutation rejected inside a batch is reported by COMMIT like the others
+            if (inBatch && (operation == "ENTITY" || operation == "RELATIONSHIP" || operation == "DELETE"))
+            {
+                batch.push_back({"ILLEGAL", {}, 0});
+            }
+            else
+            {
+                std::cout << "illegal argument" << std::endl;
+            }
         }
     }
 
+    // the same holds when the input ends inside a batch
+    if (inBatch)
+    {
+        commitBatch(graph, batch, false);
+    }
+
     return 0;
 }
@@ -0,0 +1,149 @@
+// builds the non default BasicGraph instances and checks their PATH and HIGHEST results
+// run with: make test_templates
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "Graph.hpp"
+
+int failures = 0;
+
+void check(bool condition, const std::string &message)
+{
+    if (!condition)
+    {
+        std::cout << "failure: " << message << std::endl;
+        ++failures;
+    }
+}
+
+// path of a PATH query as "id id id weight", or "failure"
+template <typename G>
+std::string path(G &graph, const std::string &sourceId, const std::string &destinationId)
+{
+    auto result = graph.findPath(sourceId, destinationId);
+    if (std::get<0>(result).empty())
+    {
+        return "failure";
+    }
+
+    std::ostringstream out;
+    for (const auto &id : std::get<0>(result))
+    {
+        out << id << " ";
+    }
+    out << std::get<1>(result);
+    return out.str();
+}
+
+// output line of HIGHEST
+template <typename G>
+std::string highest(G &graph)
+{
+    std::ostringstream out;
+    std::streambuf *previous = std::cout.rdbuf(out.rdbuf());
+    graph.findHighestPath();
+    std::cout.rdbuf(previous);
+
+    std::string line = out.str();
+    return line.substr(0, line.find('\n'));
+}
+
+// the graph of tests/test_path.in, without labels
+template <typename G>
+void buildLetters(G &graph)
+{
+    graph.addNode("123AA", "A", "letter");
+    graph.addNode("123AB", "B", "letter");
+    graph.addNode("123AC", "C", "letter");
+    graph.addNode("123AD", "D", "letter");
+    graph.addEdge("123AA", "123AB", 1);
+    graph.addEdge("123AA", "123AC", 2);
+    graph.addEdge("123AA", "123AD", 3);
+    graph.addEdge("123AB", "123AD", 2);
+}
+
+// a chain N0 - N1 - ... - N(count - 1) where every edge has the given weight
+template <typename G, typename Weight>
+void buildChain(G &graph, int count, Weight weight)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        graph.addNode("N" + std::to_string(i), "name", "type");
+        if (i > 0)
+        {
+            graph.addEdge("N" + std::to_string(i - 1), "N" + std::to_string(i), weight);
+        }
+    }
+}
+
+// two equal weight routes from S to X, one through A and one through B
+template <typename G>
+void buildTie(G &graph)
+{
+    graph.addNode("S", "name", "type");
+    graph.addNode("A", "name", "type");
+    graph.addNode("B", "name", "type");
+    graph.addNode("X", "name", "type");
+    graph.addEdge("S", "A", 1);
+    graph.addEdge("S", "B", 1);
+    graph.addEdge("A", "X", 1);
+    graph.addEdge("B", "X", 1);
+}
+
+int main()
+{
+    // integer and float weights without labels give the same results as the default graph
+    BasicGraph<int, NoLabel> intGraph;
+    BasicGraph<float, NoLabel> floatGraph;
+    Graph defaultGraph;
+    buildLetters(intGraph);
+    buildLetters(floatGraph);
+    buildLetters(defaultGraph);
+
+    check(path(defaultGraph, "123AA", "123AB") == "123AA 123AD 123AB 5", "double PATH");
+    check(path(intGraph, "123AA", "123AB") == "123AA 123AD 123AB 5", "int PATH");
+    check(path(floatGraph, "123AA", "123AB") == "123AA 123AD 123AB 5", "float PATH");
+    check(highest(intGraph) == highest(defaultGraph), "int HIGHEST");
+    check(highest(floatGraph) == highest(defaultGraph), "float HIGHEST");
+
+    intGraph.removeNode("123AD");
+    check(path(intGraph, "123AA", "123AB") == "123AA 123AB 1", "int PATH after DELETE");
+    check(path(intGraph, "123AA", "123AX") == "failure", "int PATH to a missing node");
+
+    // large path weights need no memory in proportion to the weight
+    BasicGraph<long long, std::string> largeGraph;
+    buildChain(largeGraph, 3, 2000000000LL);
+    check(highest(largeGraph) == "N0 N2 4000000000", "long long HIGHEST with large weights");
+
+    BasicGraph<int, NoLabel> chainGraph;
+    buildChain(chainGraph, 60, 100000);
+    check(highest(chainGraph) == "N0 N59 5900000", "int HIGHEST on a long chain");
+
+    // a path weight that does not fit in int is rejected
+    BasicGraph<int, NoLabel> overflowGraph;
+    buildChain(overflowGraph, 3, 2000000000);
+    bool rejected = false;
+    try
+    {
+        overflowGraph.findPath("N0", "N2");
+    }
+    catch (const illegal_exception &e)
+    {
+        rejected = true;
+    }
+    check(rejected, "int PATH overflow is rejected");
+
+    // equal weights are broken the same way for every weight type
+    BasicGraph<int, NoLabel> intTie;
+    Graph defaultTie;
+    buildTie(intTie);
+    buildTie(defaultTie);
+    check(path(intTie, "S", "X") == "S A X 2", "int tie break");
+    check(path(defaultTie, "S", "X") == "S A X 2", "double tie break");
+
+    if (failures == 0)
+    {
+        std::cout << "success" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}